@@ -0,0 +1,128 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Adaptive keys for Hands Down Gold.
+ *
+ * Some same-finger bigrams can't be avoided on the BASE layer. For those,
+ * a bigram that never occurs in English, typed with two different
+ * fingers, is rewritten into the awkward one. For example G then X (ring,
+ * pinky) types "gs" instead of G then S (both ring). A rewrite only fires
+ * when the second key comes within ADAPTIVE_TERM of the first. To type
+ * the literal pair, pause longer than that between the two keys.
+ *
+ * A trigger pair must not also be a chord in combos.def. Rolled inside
+ * COMBO_TERM, the combo fires and this never sees the keys.
+ *
+ * Rules live in a previous key x current key table in PROGMEM. Two letter
+ * index maps pick the row and column, so a lookup is three flash reads
+ * however many rules there are.
+ */
+
+#include "adaptive.h"
+
+enum adaptive_prev {
+    AP_G,
+    AP_S,
+    AP_COUNT,
+};
+
+enum adaptive_curr {
+    AC_X,
+    AC_COUNT,
+};
+
+// Letter to table index, offset by one so zero means no rules
+static const uint8_t PROGMEM prev_index[26] = {
+    [KC_G - KC_A] = AP_G + 1,
+    [KC_S - KC_A] = AP_S + 1,
+};
+
+static const uint8_t PROGMEM curr_index[26] = {
+    [KC_X - KC_A] = AC_X + 1,
+};
+
+// clang-format off
+static const uint8_t PROGMEM transitions[AP_COUNT][AC_COUNT] = {
+    //         X
+    [AP_G] = { KC_S },  // GX -> GS, ring finger (things, songs)
+    [AP_S] = { KC_F },  // SX -> SF, ring finger (transfer, satisfy)
+};
+// clang-format on
+
+static uint8_t  prev_key  = KC_NO;
+static uint16_t prev_time = 0;
+
+bool process_linger_key(uint16_t keycode, keyrecord_t *record) {
+    if (keycode != LNGR_Q || record->tap.count) {
+        return true;
+    }
+
+    // Held past TAPPING_TERM, the same timing the home row mods use
+    if (record->event.pressed) {
+        const uint8_t mods = get_mods();
+        tap_code(KC_Q);
+        del_mods(MOD_MASK_SHIFT); // Shifted gives "Qu", not "QU"
+        tap_code(KC_U);
+        set_mods(mods);
+
+        prev_key  = KC_U;
+        prev_time = record->event.time;
+    }
+    return false;
+}
+
+bool process_adaptive_key(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return true;
+    }
+
+    switch (keycode) {
+        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+            if (!record->tap.count) {
+                // Held as a modifier or layer, not typing
+                prev_key = KC_NO;
+                return true;
+            }
+            keycode &= 0xFF;
+            break;
+    }
+
+    if (keycode < KC_A || keycode > KC_Z || (get_mods() & ~MOD_MASK_SHIFT)) {
+        prev_key = KC_NO;
+        return true;
+    }
+
+    uint8_t out = KC_NO;
+    if (prev_key != KC_NO && TIMER_DIFF_16(record->event.time, prev_time) < ADAPTIVE_TERM) {
+        uint8_t row = pgm_read_byte(&prev_index[prev_key - KC_A]);
+        uint8_t col = pgm_read_byte(&curr_index[keycode - KC_A]);
+        if (row && col) {
+            out = pgm_read_byte(&transitions[row - 1][col - 1]);
+        }
+    }
+    prev_time = record->event.time;
+
+    if (out == KC_NO) {
+        prev_key = keycode;
+        return true;
+    }
+    tap_code(out);
+    prev_key = out;
+    return false;
+}
@@ -0,0 +1,105 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Per-key asymmetric debounce: eager on press, deferred on release.
+ *
+ * A press is reported on the first scan that sees it. A release is only
+ * reported once the key has read up for about DEBOUNCE ms in a row, so chatter
+ * while the switch settles after a press never reaches the host.
+ *
+ * Each key's release countdown is a 2 bit counter stored bit-sliced
+ * across two matrix_row_t planes, so the whole state is two bits per key
+ * and every row is updated with a handful of bitwise ops.
+ */
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Countdown starts at 3 and ticks every DEBOUNCE_TICK ms. The first tick
+// can land right after the countdown starts, so a release waits between
+// 2 and 3 ticks: 4-6 ms for DEBOUNCE 5, centred on DEBOUNCE.
+#define DEBOUNCE_TICK (DEBOUNCE / 2)
+
+static matrix_row_t count_hi[MATRIX_ROWS];
+static matrix_row_t count_lo[MATRIX_ROWS];
+static uint16_t     last_tick;
+
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        count_hi[row] = 0;
+        count_lo[row] = 0;
+    }
+    last_tick = timer_read();
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool cooked_changed = false;
+
+#if DEBOUNCE > 0
+    bool tick = timer_elapsed(last_tick) >= DEBOUNCE_TICK;
+    if (tick) {
+        last_tick = timer_read();
+    }
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        // Eager press: report keys that went down straight away
+        matrix_row_t pressed = raw[row] & ~cooked[row];
+        if (pressed) {
+            cooked[row] |= pressed;
+            cooked_changed = true;
+        }
+
+        // Keys reported down that read up are waiting to be released. Any
+        // key that read down again drops its countdown, new ones start at 3.
+        matrix_row_t releasing = cooked[row] & ~raw[row];
+        count_hi[row] &= releasing;
+        count_lo[row] &= releasing;
+        matrix_row_t started = releasing & ~(count_hi[row] | count_lo[row]);
+        count_hi[row] |= started;
+        count_lo[row] |= started;
+
+        if (tick && releasing) {
+            // Bit-sliced decrement of every running countdown in the row
+            matrix_row_t running = count_hi[row] | count_lo[row];
+            count_hi[row] &= count_lo[row];
+            count_lo[row] = running & ~count_lo[row];
+
+            // Deferred release: report keys whose countdown just ran out
+            matrix_row_t expired = running & ~(count_hi[row] | count_lo[row]);
+            if (expired) {
+                cooked[row] &= ~expired;
+                cooked_changed = true;
+            }
+        }
+    }
+#else
+    if (changed) {
+        for (uint8_t row = 0; row < num_rows; row++) {
+            cooked_changed |= cooked[row] ^ raw[row];
+            cooked[row] = raw[row];
+        }
+    }
+#endif
+
+    return cooked_changed;
+}
+
+void debounce_free(void) {}
\ No newline at end of file
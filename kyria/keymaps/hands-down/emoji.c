@@ -0,0 +1,130 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Unicode output with fewer reports per character.
+ *
+ * QMK's register_unicode taps every hex digit, a press report and a release
+ * report each. Here consecutive digits share a report: releasing one digit
+ * and pressing the next go out together, so n digits take about n + 1
+ * reports instead of 2n. Hosts handle the release before the press. The
+ * input mode lead-in and finish still come from QMK's unicode_input_start
+ * and unicode_input_finish, so UC_NEXT and the saved mode work as usual.
+ */
+
+#include "emoji.h"
+
+// Up to two code points per emoji, the rest of the entry is zero
+static const uint32_t PROGMEM emoji_table[][2] = {
+    [EM_JOY - EM_JOY]   = {0x1F602},         // Face with tears of joy
+    [EM_SMILE - EM_JOY] = {0x1F60A},         // Smiling face with smiling eyes
+    [EM_WINK - EM_JOY]  = {0x1F609},         // Winking face
+    [EM_THINK - EM_JOY] = {0x1F914},         // Thinking face
+    [EM_THUP - EM_JOY]  = {0x1F44D},         // Thumbs up
+    [EM_HEART - EM_JOY] = {0x2764, 0xFE0F},  // Red heart, the selector asks for emoji style over text
+    [EM_FIRE - EM_JOY]  = {0x1F525},         // Fire
+    [EM_PARTY - EM_JOY] = {0x1F389},         // Party popper
+};
+
+static uint8_t held_key = KC_NO;
+
+static void batch_tap(uint8_t keycode) {
+    if (held_key != KC_NO) {
+        del_key(held_key);
+        if (held_key == keycode) {
+            // The same key twice needs a report with it released in between
+            send_keyboard_report();
+        }
+    }
+    add_key(keycode);
+    send_keyboard_report();
+    held_key = keycode;
+#if UNICODE_BATCH_DELAY > 0
+    wait_ms(UNICODE_BATCH_DELAY);
+#endif
+}
+
+static void batch_flush(void) {
+    if (held_key != KC_NO) {
+        del_key(held_key);
+        send_keyboard_report();
+        held_key = KC_NO;
+    }
+}
+
+static uint8_t hex_keycode(uint8_t digit, uint8_t mode) {
+    if (mode == UNICODE_MODE_WINDOWS && digit < 10) {
+        // Alt + keypad entry only takes numbers from the keypad
+        return digit == 0 ? KC_KP_0 : KC_KP_1 + digit - 1;
+    }
+    if (digit < 10) {
+        return digit == 0 ? KC_0 : KC_1 + digit - 1;
+    }
+    return KC_A + digit - 10;
+}
+
+// Send only the digits the mode needs. macOS wants exactly four per UTF-16
+// unit, the others take any length.
+static void send_hex(uint32_t hex, uint8_t min_digits, uint8_t mode) {
+    uint8_t digits = 8;
+    while (digits > min_digits && !((hex >> ((digits - 1) * 4)) & 0xF)) {
+        digits--;
+    }
+
+    if (mode == UNICODE_MODE_WINCOMPOSE && ((hex >> ((digits - 1) * 4)) & 0xF) > 9) {
+        // WinCompose reads a leading letter as the start of a sequence name
+        batch_tap(KC_0);
+    }
+    while (digits--) {
+        batch_tap(hex_keycode((hex >> (digits * 4)) & 0xF, mode));
+    }
+}
+
+void send_unicode_batched(uint32_t code_point) {
+    uint8_t mode = get_unicode_input_mode();
+    if (code_point > 0x10FFFF || (code_point > 0xFFFF && mode == UNICODE_MODE_WINDOWS)) {
+        return;
+    }
+
+    unicode_input_start();
+    if (code_point > 0xFFFF && mode == UNICODE_MODE_MACOS) {
+        // Unicode Hex Input only takes UTF-16, send a surrogate pair
+        code_point -= 0x10000;
+        send_hex(0xD800 + (code_point >> 10), 4, mode);
+        send_hex(0xDC00 + (code_point & 0x3FF), 4, mode);
+    } else {
+        send_hex(code_point, mode == UNICODE_MODE_MACOS ? 4 : 1, mode);
+    }
+    batch_flush();
+    unicode_input_finish();
+}
+
+bool process_emoji(uint16_t keycode, keyrecord_t *record) {
+    if (keycode < EM_JOY || keycode >= EMOJI_SAFE_RANGE) {
+        return true;
+    }
+    if (record->event.pressed) {
+        for (uint8_t i = 0; i < 2; i++) {
+            uint32_t code_point = pgm_read_dword(&emoji_table[keycode - EM_JOY][i]);
+            if (!code_point) {
+                break;
+            }
+            send_unicode_batched(code_point);
+        }
+    }
+    return false;
+}
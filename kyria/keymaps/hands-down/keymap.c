@@ -17,6 +17,8 @@
 /* Updated 2/3/2023 */
 
 #include QMK_KEYBOARD_H
+#include "emoji.h"
+#include "adaptive.h"
 #include "g/keymap_combo.h"
 
 enum layers {
@@ -116,20 +118,20 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
  * Function Layer: Function keys, RGB
  *
  * ,-------------------------------------------.                              ,-------------------------------------------.
- * |HANDSDWN|  F9  | F10  | F11  | F12  |      |                              |      |Paste | Copy | Cut  | Undo |HANDSDWN|
+ * |HANDSDWN|  F9  | F10  | F11  | F12  |ThmUp |                              | Joy  |Paste | Copy | Cut  | Undo |HANDSDWN|
  * |--------+------+------+------+------+------|                              |------+------+------+------+------+--------|
- * | QWERTY |  F5  |  F6  |  F7  |  F8  |      |                              | RGB  | Sat+ | Hue+ |Bright| RGB+ | QWERTY |
+ * | QWERTY |  F5  |  F6  |  F7  |  F8  |Heart |                              | RGB  | Sat+ | Hue+ |Bright| RGB+ | QWERTY |
  * |--------+------+------+------+------+------+-------------.  ,-------------+------+------+------+------+------+--------|
- * |        |  F1  |  F2  |  F3  |  F4  |      |      |      |  |      |      |      | Sat- | Hue- | Dim  | RGB- |        |
+ * |UC Mode |  F1  |  F2  |  F3  |  F4  | Fire |      |      |  |      |      |Think | Sat- | Hue- | Dim  | RGB- |        |
  * `----------------------+------+------+------+------+------|  |------+------+------+------+------+----------------------'
  *                        |      |      |      |      |      |  |      |      |      |      |      |
  *                        |      |      |      |      |      |  |      |      |      |      |      |
  *                        `----------------------------------'  `----------------------------------'
  */
 [FUN] = LAYOUT
-    (DF(HANDS_DOWN), KC_F9, KC_F10  , KC_F11  , KC_F12  , KC_TRNS ,                                                      KC_TRNS , KC_PSTE , KC_COPY , KC_CUT  , KC_UNDO  , DF(HANDS_DOWN), 
-    DF(QWERTY)     , KC_F5, KC_F6   , KC_F7   , KC_F8   , KC_TRNS ,                                                      RGB_TOG , RGB_SAI , RGB_HUI , RGB_VAI , RGB_MOD  , DF(QWERTY), 
-    KC_TRNS        , KC_F1, KC_F2   , KC_F3   , KC_F4   , KC_TRNS , KC_TRNS , KC_TRNS,               KC_TRNS , KC_TRNS , KC_TRNS , RGB_SAD , RGB_HUD , RGB_VAD , RGB_RMOD , KC_TRNS, 
+    (DF(HANDS_DOWN), KC_F9, KC_F10  , KC_F11  , KC_F12  , EM_THUP  ,                                                     EM_JOY  , KC_PSTE , KC_COPY , KC_CUT  , KC_UNDO  , DF(HANDS_DOWN), 
+    DF(QWERTY)     , KC_F5, KC_F6   , KC_F7   , KC_F8   , EM_HEART ,                                                     RGB_TOG , RGB_SAI , RGB_HUI , RGB_VAI , RGB_MOD  , DF(QWERTY), 
+    UC_NEXT        , KC_F1, KC_F2   , KC_F3   , KC_F4   , EM_FIRE  , KC_TRNS , KC_TRNS,              KC_TRNS , KC_TRNS , EM_THINK, RGB_SAD , RGB_HUD , RGB_VAD , RGB_RMOD , KC_TRNS, 
                                       KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS,               KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS),
 
 /*
@@ -153,6 +155,20 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
                                   KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS ,                   KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS , KC_TRNS),
 };
 
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (!process_emoji(keycode, record)) {
+        return false;
+    }
+    if (!process_linger_key(keycode, record)) {
+        return false;
+    }
+    // Adaptive keys only make sense on the Hands Down base layer
+    if (get_highest_layer(default_layer_state) == HANDS_DOWN && !process_adaptive_key(keycode, record)) {
+        return false;
+    }
+    return true;
+}
+
 #ifdef OLED_ENABLE
 oled_rotation_t oled_init_user(oled_rotation_t rotation) { return OLED_ROTATION_180; }
 
@@ -8,4 +8,12 @@ LEADER_ENABLE    = no 	   # Enable the Leader Key feature
 MOUSEKEY_ENABLE  = yes	   # Enable the Mousekeys feature
 COMBO_ENABLE     = yes     # Enable the Combos feature. IE, f+c = CTL + V for paste, etc. 
 TAP_DANCE_ENABLE = no 	   # Enable the Tap Dance feature. Single tap = keycode, double-tap = difference keycode, etc.
-LTO_ENABLE 	     = yes     # Longer compile, smaller file; disables deprecated functionality
\ No newline at end of file
+LTO_ENABLE 	     = yes     # Longer compile, smaller file; disables deprecated functionality
+UNICODE_ENABLE   = yes     # Unicode input modes for the emoji keys (emoji.c)
+DEBOUNCE_TYPE    = custom  # Per-key eager press, deferred release (eager_debounce.c). sym_defer_g is the QMK default
+
+SRC += emoji.c adaptive.c idle.c
+
+ifeq ($(strip $(DEBOUNCE_TYPE)), custom)
+    SRC += eager_debounce.c
+endif
\ No newline at end of file
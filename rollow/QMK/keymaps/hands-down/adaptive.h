@@ -0,0 +1,29 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "quantum.h"
+
+#ifndef ADAPTIVE_TERM
+#    define ADAPTIVE_TERM 250 // ms after a key that it can still change the next one
+#endif
+
+#define LNGR_Q LT(0, KC_Q) // Tap for Q, hold past TAPPING_TERM for "qu"
+
+bool process_linger_key(uint16_t keycode, keyrecord_t *record);
+bool process_adaptive_key(uint16_t keycode, keyrecord_t *record);
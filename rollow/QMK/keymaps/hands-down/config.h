@@ -21,4 +21,17 @@ XXX,  K20,  K21,  K22,  K23,  K24,         K25,  K26,  K27,  K28,  K29,  XXX , \
 )
 
 #define TAPPING_TERM 200
-#define IGNORE_MOD_TAP_INTERRUPT    // Lets you roll mod-tap keys
\ No newline at end of file
+#define IGNORE_MOD_TAP_INTERRUPT    // Lets you roll mod-tap keys
+#define ADAPTIVE_TERM 250           // ms after a key that an adaptive key can still rewrite the next one
+#define DEBOUNCE 5                  // Release is reported after the key reads up for 2-3 ticks of DEBOUNCE/2 ms, 4-6 ms
+
+#define IDLE_TIMEOUT 30000          // ms without input before dropping to the idle scan rate
+#define IDLE_SCAN_INTERVAL 10       // ms between matrix scans while idle, first change wakes back to full rate
+#define OLED_TIMEOUT IDLE_TIMEOUT   // Blank the OLEDs in step with the idle scan rate
+#define SPLIT_ACTIVITY_ENABLE       // Both halves go idle on the same input activity
+
+#define UNICODE_SELECTED_MODES UNICODE_MODE_LINUX, UNICODE_MODE_MACOS, UNICODE_MODE_WINCOMPOSE // Cycle with UC_NEXT
+#define UNICODE_BATCH_DELAY 0       // ms between batched emoji reports, raise if the host drops digits
+
+#define DYNAMIC_KEYS_LAYERS 10      // Layers stored in EEPROM, must match the keymap
+#define DYNAMIC_KEYS_CACHE_LAYERS DYNAMIC_KEYS_LAYERS // TG keys can stack any layers, so every layer gets a RAM slot
\ No newline at end of file
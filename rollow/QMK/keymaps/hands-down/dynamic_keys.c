@@ -0,0 +1,257 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Runtime-editable keymap and combo results, stored in EEPROM.
+ *
+ * keymap_key_to_keycode never reads EEPROM. A layer that differs from the
+ * compiled-in keymap gets a RAM copy at boot, and any other layer gets one
+ * on its first edit. Edits are written through to EEPROM and RAM. Layers
+ * that were never edited still read from PROGMEM like a normal keymap.
+ * EEPROM is only read at boot and when an edit caches a layer, never on a
+ * layer change.
+ *
+ * A checksum of each compiled-in layer and of the combos is stored next to
+ * the EEPROM copy. When a reflash changes a layer, that layer is reseeded
+ * from the new firmware and any edits to it are dropped. Changing combos.def
+ * reseeds every combo result, since they are stored by index.
+ */
+
+#include "dynamic_keys.h"
+#include "eeprom.h"
+#include "raw_hid.h"
+
+#define DYNAMIC_KEYS_MAGIC 0x4B44 // EEPROM layout, change it when the layout below changes
+#define NO_SLOT 0xFF
+
+#define LAYER_BYTES (MATRIX_ROWS * MATRIX_COLS * sizeof(uint16_t))
+#define MAGIC_ADDR ((uint16_t *)DYNAMIC_KEYS_EEPROM_START)
+#define LAYER_SUM_ADDR (DYNAMIC_KEYS_EEPROM_START + sizeof(uint16_t))
+#define COMBO_SUM_ADDR ((uint16_t *)(LAYER_SUM_ADDR + DYNAMIC_KEYS_LAYERS * sizeof(uint16_t)))
+#define KEYMAP_ADDR ((uintptr_t)COMBO_SUM_ADDR + sizeof(uint16_t))
+#define COMBO_ADDR (KEYMAP_ADDR + DYNAMIC_KEYS_LAYERS * LAYER_BYTES)
+#define DYNAMIC_KEYS_EEPROM_END (COMBO_ADDR + DYNAMIC_KEYS_MAX_COMBOS * sizeof(uint16_t))
+
+#ifdef TOTAL_EEPROM_BYTE_COUNT
+_Static_assert(DYNAMIC_KEYS_EEPROM_END <= TOTAL_EEPROM_BYTE_COUNT, "Dynamic keymap does not fit in EEPROM");
+#endif
+
+static uint16_t cache[DYNAMIC_KEYS_CACHE_LAYERS][MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  slot_of[DYNAMIC_KEYS_LAYERS];
+static uint8_t  slots_used = 0;
+static bool     is_ready   = false;
+
+_Static_assert(sizeof(cache) <= DYNAMIC_KEYS_CACHE_MAX_BYTES, "Keymap cache is over its RAM budget, lower DYNAMIC_KEYS_CACHE_LAYERS");
+
+static combo_t *combos;
+static uint8_t  combo_count;
+
+static uint16_t *keycode_addr(uint8_t layer, uint8_t row, uint8_t col) {
+    return (uint16_t *)(KEYMAP_ADDR + LAYER_BYTES * layer + sizeof(uint16_t) * (row * MATRIX_COLS + col));
+}
+
+static uint16_t *combo_addr(uint8_t index) {
+    return (uint16_t *)(COMBO_ADDR + sizeof(uint16_t) * index);
+}
+
+static uint16_t *layer_sum_addr(uint8_t layer) {
+    return (uint16_t *)(LAYER_SUM_ADDR + sizeof(uint16_t) * layer);
+}
+
+static uint16_t checksum_add(uint16_t sum, uint16_t word) {
+    return sum * 31 + word;
+}
+
+static uint16_t layer_checksum(uint8_t layer) {
+    uint16_t sum = 1;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            sum = checksum_add(sum, pgm_read_word(&keymaps[layer][row][col]));
+        }
+    }
+    return sum;
+}
+
+// Covers the chords as well as the results, so reordering combos.def counts
+static uint16_t combo_checksum(void) {
+    uint16_t sum = checksum_add(1, combo_count);
+    for (uint8_t i = 0; i < combo_count; i++) {
+        const uint16_t *keys = combos[i].keys;
+        uint16_t        key;
+        while ((key = pgm_read_word(keys++)) != COMBO_END) {
+            sum = checksum_add(sum, key);
+        }
+        sum = checksum_add(checksum_add(sum, COMBO_END), combos[i].keycode);
+    }
+    return sum;
+}
+
+static bool is_valid_key(uint8_t layer, uint8_t row, uint8_t col) {
+    return layer < DYNAMIC_KEYS_LAYERS && row < MATRIX_ROWS && col < MATRIX_COLS;
+}
+
+static void seed_layer(uint8_t layer) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            eeprom_update_word(keycode_addr(layer, row, col), pgm_read_word(&keymaps[layer][row][col]));
+        }
+    }
+}
+
+static bool is_edited(uint8_t layer) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (eeprom_read_word(keycode_addr(layer, row, col)) != pgm_read_word(&keymaps[layer][row][col])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Give a layer its RAM copy. Fails once every slot is taken, which only
+// happens when DYNAMIC_KEYS_CACHE_LAYERS is set below the layer count.
+static bool cache_layer(uint8_t layer) {
+    if (slot_of[layer] != NO_SLOT) {
+        return true;
+    }
+    if (slots_used == DYNAMIC_KEYS_CACHE_LAYERS) {
+        return false;
+    }
+    eeprom_read_block(cache[slots_used], (const void *)keycode_addr(layer, 0, 0), LAYER_BYTES);
+    slot_of[layer] = slots_used++;
+    return true;
+}
+
+void dynamic_keys_init(combo_t *keymap_combos, uint8_t keymap_combo_count) {
+    combos      = keymap_combos;
+    combo_count = MIN(keymap_combo_count, DYNAMIC_KEYS_MAX_COMBOS);
+    memset(slot_of, NO_SLOT, sizeof(slot_of));
+
+    // Anything the compiled-in firmware changed since the last boot is
+    // reseeded, everything else keeps its edits
+    bool formatted = eeprom_read_word(MAGIC_ADDR) == DYNAMIC_KEYS_MAGIC;
+
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYS_LAYERS; layer++) {
+        uint16_t sum = layer_checksum(layer);
+        if (!formatted || eeprom_read_word(layer_sum_addr(layer)) != sum) {
+            seed_layer(layer);
+            eeprom_update_word(layer_sum_addr(layer), sum);
+        } else if (is_edited(layer)) {
+            cache_layer(layer);
+        }
+    }
+
+    // Called before key_combos is touched, so these are the compiled-in results
+    uint16_t sum = combo_checksum();
+    if (!formatted || eeprom_read_word(COMBO_SUM_ADDR) != sum) {
+        for (uint8_t i = 0; i < combo_count; i++) {
+            eeprom_update_word(combo_addr(i), combos[i].keycode);
+        }
+        eeprom_update_word(COMBO_SUM_ADDR, sum);
+    } else {
+        for (uint8_t i = 0; i < combo_count; i++) {
+            combos[i].keycode = eeprom_read_word(combo_addr(i));
+        }
+    }
+
+    eeprom_update_word(MAGIC_ADDR, DYNAMIC_KEYS_MAGIC);
+    is_ready = true;
+}
+
+void dynamic_keys_invalidate(void) {
+    eeprom_update_word(MAGIC_ADDR, 0);
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    if (!is_valid_key(layer, key.row, key.col)) {
+        return KC_NO;
+    }
+
+    uint8_t slot = is_ready ? slot_of[layer] : NO_SLOT;
+    if (slot != NO_SLOT) {
+        return cache[slot][key.row][key.col];
+    }
+    return pgm_read_word(&keymaps[layer][key.row][key.col]);
+}
+
+static bool set_keycode(uint8_t layer, uint8_t row, uint8_t col, uint16_t keycode) {
+    if (!is_valid_key(layer, row, col) || !cache_layer(layer)) {
+        return false;
+    }
+    eeprom_update_word(keycode_addr(layer, row, col), keycode);
+    cache[slot_of[layer]][row][col] = keycode;
+    return true;
+}
+
+static bool set_combo(uint8_t index, uint16_t keycode) {
+    if (index >= combo_count) {
+        return false;
+    }
+    eeprom_update_word(combo_addr(index), keycode);
+    combos[index].keycode = keycode;
+    return true;
+}
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    bool ok = is_ready;
+
+    if (ok) {
+        switch (data[0]) {
+            case DK_GET_INFO:
+                data[1] = DYNAMIC_KEYS_LAYERS;
+                data[2] = MATRIX_ROWS;
+                data[3] = MATRIX_COLS;
+                data[4] = combo_count;
+                break;
+            case DK_GET_KEYCODE:
+                ok = is_valid_key(data[1], data[2], data[3]);
+                if (ok) {
+                    keypos_t key = {.row = data[2], .col = data[3]};
+                    uint16_t kc  = keymap_key_to_keycode(data[1], key);
+                    data[4]      = kc >> 8;
+                    data[5]      = kc & 0xFF;
+                }
+                break;
+            case DK_SET_KEYCODE:
+                ok = set_keycode(data[1], data[2], data[3], (data[4] << 8) | data[5]);
+                break;
+            case DK_GET_COMBO:
+                ok = data[1] < combo_count;
+                if (ok) {
+                    data[2] = combos[data[1]].keycode >> 8;
+                    data[3] = combos[data[1]].keycode & 0xFF;
+                }
+                break;
+            case DK_SET_COMBO:
+                ok = set_combo(data[1], (data[2] << 8) | data[3]);
+                break;
+            case DK_RESET:
+                dynamic_keys_invalidate();
+                raw_hid_send(data, length);
+                soft_reset_keyboard();
+                return;
+            default:
+                ok = false;
+        }
+    }
+
+    if (!ok) {
+        data[0] = DK_ERROR;
+    }
+    raw_hid_send(data, length);
+}
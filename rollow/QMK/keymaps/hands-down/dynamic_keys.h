@@ -0,0 +1,50 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "quantum.h"
+
+#ifndef DYNAMIC_KEYS_LAYERS
+#    define DYNAMIC_KEYS_LAYERS 10
+#endif
+#ifndef DYNAMIC_KEYS_CACHE_LAYERS
+#    define DYNAMIC_KEYS_CACHE_LAYERS DYNAMIC_KEYS_LAYERS // Edited layers that can have a RAM copy
+#endif
+#ifndef DYNAMIC_KEYS_CACHE_MAX_BYTES
+#    define DYNAMIC_KEYS_CACHE_MAX_BYTES 1024 // RAM budget for those copies
+#endif
+#ifndef DYNAMIC_KEYS_MAX_COMBOS
+#    define DYNAMIC_KEYS_MAX_COMBOS 32
+#endif
+#ifndef DYNAMIC_KEYS_EEPROM_START
+#    define DYNAMIC_KEYS_EEPROM_START EECONFIG_SIZE
+#endif
+
+// Raw HID commands, byte 0 of every report. Keycodes are sent high byte first.
+enum dynamic_keys_command {
+    DK_GET_INFO = 0x01, // -> layers, rows, cols, combo count
+    DK_GET_KEYCODE,     // layer, row, col -> keycode
+    DK_SET_KEYCODE,     // layer, row, col, keycode, fails when no cache slot is left
+    DK_GET_COMBO,       // index -> keycode
+    DK_SET_COMBO,       // index, keycode
+    DK_RESET,           // Reseed from the compiled-in keymap and reboot
+    DK_ERROR = 0xFF,    // Sent back in place of the command when it fails
+};
+
+void dynamic_keys_init(combo_t *combos, uint8_t combo_count);
+void dynamic_keys_invalidate(void);
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# Copyright 2023 Sam Jolley
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+
+"""Edit the Rollow's keymap and combos over raw HID, no reflash needed.
+
+Talks to dynamic_keys.c through /dev/hidrawN (needs read/write access to it).
+Keycodes are the numeric QMK values, e.g. 0x0004 for KC_A.
+
+    dynamic_keys.py info
+    dynamic_keys.py get LAYER ROW COL
+    dynamic_keys.py set LAYER ROW COL KEYCODE
+    dynamic_keys.py dump LAYER
+    dynamic_keys.py combo-get INDEX
+    dynamic_keys.py combo-set INDEX KEYCODE
+    dynamic_keys.py reset
+"""
+
+import glob
+import os
+import sys
+
+REPORT_SIZE = 32
+RAW_USAGE = bytes([0x06, 0x60, 0xFF, 0x09, 0x61])  # QMK raw HID usage page 0xFF60, usage 0x61
+
+DK_GET_INFO, DK_GET_KEYCODE, DK_SET_KEYCODE, DK_GET_COMBO, DK_SET_COMBO, DK_RESET = range(1, 7)
+DK_ERROR = 0xFF
+
+
+def find_device():
+    for path in sorted(glob.glob("/sys/class/hidraw/hidraw*")):
+        with open(os.path.join(path, "device", "report_descriptor"), "rb") as f:
+            if RAW_USAGE in f.read():
+                return "/dev/" + os.path.basename(path)
+    sys.exit("No QMK raw HID device found")
+
+
+def send(dev, *payload):
+    report = bytes(payload).ljust(REPORT_SIZE, b"\0")
+    os.write(dev, b"\0" + report)  # Leading report ID
+    reply = os.read(dev, REPORT_SIZE)
+    if reply[0] == DK_ERROR:
+        sys.exit("Keyboard rejected the command")
+    return reply
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit(__doc__)
+    cmd = argv[1]
+    args = [int(a, 0) for a in argv[2:]]
+
+    dev = os.open(find_device(), os.O_RDWR)
+    try:
+        if cmd == "info":
+            r = send(dev, DK_GET_INFO)
+            print(f"layers {r[1]}, matrix {r[2]}x{r[3]}, combos {r[4]}")
+        elif cmd == "get":
+            r = send(dev, DK_GET_KEYCODE, *args[:3])
+            print(f"0x{r[4] << 8 | r[5]:04X}")
+        elif cmd == "set":
+            layer, row, col, kc = args
+            send(dev, DK_SET_KEYCODE, layer, row, col, kc >> 8, kc & 0xFF)
+        elif cmd == "dump":
+            info = send(dev, DK_GET_INFO)
+            for row in range(info[2]):
+                codes = []
+                for col in range(info[3]):
+                    r = send(dev, DK_GET_KEYCODE, args[0], row, col)
+                    codes.append(f"0x{r[4] << 8 | r[5]:04X}")
+                print(" ".join(codes))
+        elif cmd == "combo-get":
+            r = send(dev, DK_GET_COMBO, args[0])
+            print(f"0x{r[2] << 8 | r[3]:04X}")
+        elif cmd == "combo-set":
+            index, kc = args
+            send(dev, DK_SET_COMBO, index, kc >> 8, kc & 0xFF)
+        elif cmd == "reset":
+            send(dev, DK_RESET)
+        else:
+            sys.exit(__doc__)
+    finally:
+        os.close(dev)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
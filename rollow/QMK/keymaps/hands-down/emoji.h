@@ -0,0 +1,39 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "quantum.h"
+
+#ifndef UNICODE_BATCH_DELAY
+#    define UNICODE_BATCH_DELAY 0 // ms between batched reports, raise if the host drops digits
+#endif
+
+enum emoji_keycodes {
+    EM_JOY = SAFE_RANGE,
+    EM_SMILE,
+    EM_WINK,
+    EM_THINK,
+    EM_THUP,
+    EM_HEART,
+    EM_FIRE,
+    EM_PARTY,
+    EMOJI_SAFE_RANGE,
+};
+
+void send_unicode_batched(uint32_t code_point);
+bool process_emoji(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,82 @@
+/* Copyright 2023 Sam Jolley
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Idle scan throttling.
+ *
+ * After IDLE_TIMEOUT ms without input the matrix is only scanned every
+ * IDLE_SCAN_INTERVAL ms. Skipped scans return straight to the main loop,
+ * so USB, split sync, encoders and the OLEDs keep running. The first
+ * change a scan sees counts as activity and brings back full rate. With
+ * SPLIT_ACTIVITY_ENABLE both halves share the same activity timer.
+ *
+ * While idle the MCU sleeps between main loop passes where the platform
+ * can, which is where the power saving comes from.
+ */
+
+#include "quantum.h"
+
+#if defined(__AVR__)
+#    include <avr/sleep.h>
+#endif
+
+#ifndef IDLE_TIMEOUT
+#    define IDLE_TIMEOUT 30000
+#endif
+#ifndef IDLE_SCAN_INTERVAL
+#    define IDLE_SCAN_INTERVAL 10
+#endif
+
+static bool     is_idle   = false;
+static uint16_t last_scan = 0;
+
+bool matrix_can_read(void) {
+    if (!is_idle) {
+        return true;
+    }
+    if (timer_elapsed(last_scan) < IDLE_SCAN_INTERVAL) {
+        return false;
+    }
+    last_scan = timer_read();
+    return true;
+}
+
+void housekeeping_task_user(void) {
+    bool idle = last_input_activity_elapsed() >= IDLE_TIMEOUT;
+    if (idle != is_idle) {
+        is_idle   = idle;
+        last_scan = timer_read();
+#ifdef RGBLIGHT_ENABLE
+        if (idle) {
+            rgblight_suspend();
+        } else {
+            rgblight_wakeup();
+        }
+#endif
+    }
+
+    if (is_idle) {
+#if defined(__AVR__)
+        // Sleep until the next interrupt, the 1 ms timer tick at the latest
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_mode();
+#elif defined(PROTOCOL_CHIBIOS)
+        // A thread sleep, so the ChibiOS idle thread can WFI
+        wait_ms(1);
+#endif
+    }
+}
@@ -19,7 +19,10 @@
 /* Updated 2/3/2023 */
 
 #include QMK_KEYBOARD_H
+#include "emoji.h"
+#include "adaptive.h"
 #include "g/keymap_combo.h"
+#include "dynamic_keys.h"
 
 enum layers {
     BASE = 0,        // Default alpha layer - Hands Down Gold (Neu-tx)
@@ -190,12 +193,12 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 
 /*
- * Media Layer
+ * Media Layer: Media, emoji
  *
  *,----------------------------------.                              ,----------------------------------.
- * | Boot |To Tap|ToXtra|ToBase|      |                              |      |      |      |      |      |
+ * | Boot |To Tap|ToXtra|ToBase|      |                              | Joy  |Smile | Wink |Think |UCMode|
  * |------+------+------+------+------|                              |------+------+------+------+------|
- * | Ctrl |  Alt | Gui  | Shift|      |                              |      |      |      |      |      | 
+ * | Ctrl |  Alt | Gui  | Shift|      |                              |ThmUp |Heart | Fire |Party |      | 
  * |------+------+------+------+------|                              |------+------+------+------+------|
  * |      |      |To Fun|ToMdia|      |                              |      |      |      |      |      |
  * `------+------+------+------+------|------.                ,------|------+------+------+-------------'
@@ -205,8 +208,8 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
  *                      `--------------------'                `--------------------'
  */
 [MEDIA] = LAYOUT
-    (RESET  , TG(TAP) , TG(EXTRA) , TG(BASE)  , KC_TRNS ,                           KC_TRNS             , KC_TRNS    , KC_TRNS , KC_TRNS , KC_TRNS , 
-    KC_LCTL , KC_LALT , KC_LGUI   , KC_LSFT   , KC_TRNS ,                           KC_TRNS             , KC_TRNS    , KC_TRNS , KC_TRNS , KC_TRNS , 
+    (RESET  , TG(TAP) , TG(EXTRA) , TG(BASE)  , KC_TRNS ,                           EM_JOY              , EM_SMILE   , EM_WINK , EM_THINK, UC_NEXT , 
+    KC_LCTL , KC_LALT , KC_LGUI   , KC_LSFT   , KC_TRNS ,                           EM_THUP             , EM_HEART   , EM_FIRE , EM_PARTY, KC_TRNS , 
     KC_TRNS , KC_RALT , TG(FUN)   , TG(MEDIA) , KC_TRNS ,                           KC_TRNS             , KC_TRNS    , KC_TRNS , KC_TRNS , KC_TRNS , 
                                      KC_TRNS  , KC_TRNS , KC_TRNS,        KC_STOP , KC_MEDIA_PLAY_PAUSE , KC__MUTE ) , 
 
@@ -280,6 +283,32 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 };
 
+_Static_assert(sizeof(keymaps) / sizeof(keymaps[0]) == DYNAMIC_KEYS_LAYERS, "DYNAMIC_KEYS_LAYERS must match the keymap");
+
+void keyboard_post_init_user(void) {
+    // Load edited combos and layers out of EEPROM
+    dynamic_keys_init(key_combos, COMBO_LENGTH);
+}
+
+void eeconfig_init_user(void) {
+    // EEPROM was cleared, reseed the dynamic keymap on next boot
+    dynamic_keys_invalidate();
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (!process_emoji(keycode, record)) {
+        return false;
+    }
+    if (!process_linger_key(keycode, record)) {
+        return false;
+    }
+    // Adaptive keys only make sense on the Hands Down base layer
+    if (!layer_state_is(EXTRA) && !process_adaptive_key(keycode, record)) {
+        return false;
+    }
+    return true;
+}
+
 
 #ifdef OLED_ENABLE
 oled_rotation_t oled_init_user(oled_rotation_t rotation) { return OLED_ROTATION_180; }
@@ -339,8 +368,9 @@ bool oled_task_user(void) {
         oled_write_P(led_usb_state.num_lock    ? PSTR("NUMLCK ") : PSTR("       "), false);
         oled_write_P(led_usb_state.caps_lock   ? PSTR("CAPLCK ") : PSTR("       "), false);
         oled_write_P(led_usb_state.scroll_lock ? PSTR("SCRLCK ") : PSTR("       "), false);
+    }
+    return false;
 }
-
 #endif
 
 #ifdef ENCODER_ENABLE
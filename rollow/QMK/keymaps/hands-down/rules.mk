@@ -15,4 +15,13 @@ COMBO_ENABLE    		    = yes     # Enable the Combos feature. IE, f+c = CTL + V f
 TAP_DANCE_ENABLE		    = no 	   # Enable the Tap Dance feature. Single tap = keycode, double-tap = difference keycode, etc.
 LTO_ENABLE 	    		    = yes     # Longer compile, smaller file; disables deprecated functionality
 EXTRAKEY_ENABLE 		    = yes
-MIRYOKU_KLUDGE_THUMBCOMBOS  = yes
\ No newline at end of file
+UNICODE_ENABLE  		    = yes     # Unicode input modes for the emoji keys (emoji.c)
+MIRYOKU_KLUDGE_THUMBCOMBOS  = yes
+RAW_ENABLE      		    = yes     # Raw HID, used by dynamic_keys.py to edit the keymap and combos
+DEBOUNCE_TYPE   		    = custom  # Per-key eager press, deferred release (eager_debounce.c). sym_defer_g is the QMK default
+
+SRC += dynamic_keys.c emoji.c adaptive.c idle.c
+
+ifeq ($(strip $(DEBOUNCE_TYPE)), custom)
+    SRC += eager_debounce.c
+endif
\ No newline at end of file
@@ -0,0 +1,183 @@
+/* Feeds synthetic bouncing switch signals through a debounce algorithm and
+ * reports press and release latency and how much chatter gets through.
+ * Built once per algorithm, see the Makefile. */
+
+#include "debounce.h"
+
+#ifndef ALGORITHM
+#    define ALGORITHM "?"
+#endif
+
+#define KEYS 4            // Independent keys typed at once, in one matrix row
+#define STROKES 1000      // Keystrokes per key
+#define SCAN_US 250       // Time between matrix scans
+#define MAX_TOGGLES 40000 // Per key timeline
+
+typedef struct {
+    uint32_t press_us;   // First contact
+    uint32_t release_us; // First break
+    bool     reported;
+    bool     released;
+} stroke_t;
+
+typedef struct {
+    uint32_t toggles[MAX_TOGGLES];
+    uint32_t n_toggles;
+    stroke_t strokes[STROKES];
+    uint32_t n_strokes;
+} timeline_t;
+
+typedef struct {
+    const char *name;
+    uint32_t    max_bounce_us; // Bounce after every make and break
+    uint32_t    spikes;        // Noise spikes per key while it is up, no keystrokes
+} scenario_t;
+
+uint32_t stub_now_us;
+
+static timeline_t keys[KEYS];
+static uint32_t   rng = 0x2545F491;
+
+static uint32_t rand_range(uint32_t lo, uint32_t hi) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return lo + rng % (hi - lo + 1);
+}
+
+static void toggle(timeline_t *k, uint32_t t) {
+    k->toggles[k->n_toggles++] = t;
+}
+
+// Settles in the opposite state to the one it started in, chattering for up
+// to max_bounce_us first. Returns the time it settled.
+static uint32_t edge(timeline_t *k, uint32_t t, uint32_t max_bounce_us) {
+    uint32_t end   = t + (max_bounce_us ? rand_range(0, max_bounce_us) : 0);
+    uint32_t count = 1;
+    toggle(k, t);
+    while (max_bounce_us && (t += rand_range(50, 800)) < end) {
+        toggle(k, t);
+        count++;
+    }
+    if (!(count & 1)) {
+        toggle(k, t);
+    }
+    return t;
+}
+
+static void generate(const scenario_t *sc) {
+    for (int i = 0; i < KEYS; i++) {
+        timeline_t *k = &keys[i];
+        uint32_t    t = rand_range(1000, 50000);
+        k->n_toggles  = 0;
+        k->n_strokes  = 0;
+
+        if (sc->spikes) {
+            for (uint32_t s = 0; s < sc->spikes; s++) {
+                t += rand_range(20000, 200000);
+                toggle(k, t);
+                toggle(k, t + rand_range(100, 300));
+            }
+            continue;
+        }
+        for (uint32_t s = 0; s < STROKES; s++) {
+            stroke_t *st   = &k->strokes[k->n_strokes++];
+            st->press_us   = t;
+            st->reported   = false;
+            st->released   = false;
+            t              = edge(k, t, sc->max_bounce_us) + rand_range(40000, 120000);
+            st->release_us = t;
+            t              = edge(k, t, sc->max_bounce_us) + rand_range(30000, 200000);
+        }
+    }
+}
+
+static void run(const scenario_t *sc) {
+    matrix_row_t raw[1] = {0}, cooked[1] = {0}, last_raw = 0;
+    uint32_t     next_toggle[KEYS] = {0}, current[KEYS] = {0};
+    uint64_t     press_sum = 0, release_sum = 0;
+    uint32_t     press_max = 0, release_max = 0, presses = 0, releases = 0;
+    uint32_t     spurious = 0, early = 0, missed = 0, end = 0;
+
+    generate(sc);
+    for (int i = 0; i < KEYS; i++) {
+        uint32_t last = keys[i].toggles[keys[i].n_toggles - 1];
+        end           = last > end ? last : end;
+    }
+    end += 50000;
+
+    stub_now_us = 0;
+    debounce_init(1);
+    for (stub_now_us = 0; stub_now_us < end; stub_now_us += SCAN_US) {
+        raw[0] = 0;
+        for (int i = 0; i < KEYS; i++) {
+            timeline_t *k = &keys[i];
+            while (next_toggle[i] < k->n_toggles && k->toggles[next_toggle[i]] <= stub_now_us) {
+                next_toggle[i]++;
+            }
+            raw[0] |= (next_toggle[i] & 1) << i;
+        }
+
+        matrix_row_t before = cooked[0];
+        debounce(raw, cooked, 1, raw[0] != last_raw);
+        last_raw = raw[0];
+
+        for (int i = 0; i < KEYS; i++) {
+            timeline_t *k = &keys[i];
+            while (current[i] + 1 < k->n_strokes && k->strokes[current[i] + 1].press_us <= stub_now_us) {
+                missed += !k->strokes[current[i]].reported;
+                current[i]++;
+            }
+            stroke_t *st     = k->n_strokes ? &k->strokes[current[i]] : NULL;
+            bool      was    = before & (1 << i);
+            bool      is_now = cooked[0] & (1 << i);
+
+            if (!was && is_now) {
+                if (st && !st->reported && stub_now_us >= st->press_us) {
+                    uint32_t lat = stub_now_us - st->press_us;
+                    st->reported = true;
+                    press_sum += lat;
+                    press_max = lat > press_max ? lat : press_max;
+                    presses++;
+                } else {
+                    spurious++;
+                }
+            } else if (was && !is_now) {
+                if (st && st->reported && !st->released && stub_now_us >= st->release_us) {
+                    uint32_t lat = stub_now_us - st->release_us;
+                    st->released = true;
+                    release_sum += lat;
+                    release_max = lat > release_max ? lat : release_max;
+                    releases++;
+                } else {
+                    early++;
+                }
+            }
+        }
+    }
+    for (int i = 0; i < KEYS; i++) {
+        if (keys[i].n_strokes) {
+            missed += !keys[i].strokes[current[i]].reported;
+        }
+    }
+
+    printf("%-12s %-14s %8u %6.2f %6.2f %6.2f %6.2f %9u %7u %7u\n", ALGORITHM, sc->name, presses + missed, presses ? press_sum / 1000.0 / presses : 0, press_max / 1000.0, releases ? release_sum / 1000.0 / releases : 0, release_max / 1000.0, spurious, early, missed);
+}
+
+// clang-format off
+static const scenario_t scenarios[] = {
+    { "clean",             0,   0 },
+    { "bounce 5ms",     5000,   0 },
+    { "bounce 10ms",   10000,   0 },
+    { "noise spikes",      0, 200 },
+};
+// clang-format on
+
+int main(void) {
+    printf("%-12s %-14s %8s %6s %6s %6s %6s %9s %7s %7s\n", "algorithm", "signal", "strokes", "press", "max", "rel", "max", "spurious", "early", "missed");
+    printf("%-12s %-14s %8s %6s %6s %6s %6s %9s %7s %7s\n", "", "", "", "(ms)", "(ms)", "(ms)", "(ms)", "presses", "release", "");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        run(&scenarios[i]);
+    }
+    return 0;
+}
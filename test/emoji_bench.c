@@ -0,0 +1,146 @@
+/* Counts keyboard reports and time per code point for each Unicode input
+ * mode, batched (emoji.c) against QMK's one tap per hex digit. Every report
+ * costs one USB poll interval, the rest of the time is the delays QMK adds.
+ * unicode_input_start/finish follow quantum/unicode/unicode.c, and are
+ * the same cost either way. */
+
+#include "emoji.h"
+
+#define REPORT_US 1000       // USB_POLLING_INTERVAL_MS 1, one report per poll
+#define UNICODE_TYPE_DELAY 10 // QMK default, after the input mode lead-in
+
+uint32_t       stub_now_us;
+static uint8_t mode;
+static int     reports;
+
+uint8_t get_unicode_input_mode(void) {
+    return mode;
+}
+void add_key(uint8_t keycode) {}
+void del_key(uint8_t keycode) {}
+void send_keyboard_report(void) {
+    reports++;
+    stub_now_us += REPORT_US;
+}
+void wait_ms(uint16_t ms) {
+    stub_now_us += ms * 1000;
+}
+void tap_code(uint8_t keycode) {
+    send_keyboard_report();
+    send_keyboard_report();
+}
+
+// Reports each lead-in and finish sends in QMK, mods count as one report
+void unicode_input_start(void) {
+    switch (mode) {
+        case UNICODE_MODE_MACOS: // Hold Option
+            send_keyboard_report();
+            break;
+        case UNICODE_MODE_LINUX: // Ctrl+Shift+U, then release the mods
+            send_keyboard_report();
+            send_keyboard_report();
+            send_keyboard_report();
+            break;
+        case UNICODE_MODE_WINDOWS: // Hold Alt, tap keypad +
+            send_keyboard_report();
+            tap_code(0);
+            break;
+        case UNICODE_MODE_WINCOMPOSE: // Tap the compose key, then U
+            tap_code(0);
+            tap_code(0);
+            break;
+    }
+    wait_ms(UNICODE_TYPE_DELAY);
+}
+void unicode_input_finish(void) {
+    switch (mode) {
+        case UNICODE_MODE_MACOS:
+        case UNICODE_MODE_WINDOWS: // Release the held mod
+            send_keyboard_report();
+            break;
+        case UNICODE_MODE_LINUX: // Space
+        case UNICODE_MODE_WINCOMPOSE: // Enter
+            tap_code(0);
+            break;
+    }
+}
+
+// QMK's register_hex32: at least four digits, every digit a full tap
+static void tap_hex(uint32_t hex) {
+    bool first = true;
+    for (int i = 7; i >= 0; i--) {
+        uint8_t digit = (hex >> (i * 4)) & 0xF;
+        if (first && (digit != 0 || i < 4)) {
+            if (mode == UNICODE_MODE_WINCOMPOSE && digit > 9) {
+                tap_code(0);
+            }
+            first = false;
+        }
+        if (!first) {
+            tap_code(0);
+        }
+    }
+}
+
+// QMK's register_unicode
+static void send_unicode_tapped(uint32_t code_point) {
+    if (code_point > 0x10FFFF || (code_point > 0xFFFF && mode == UNICODE_MODE_WINDOWS)) {
+        return;
+    }
+    unicode_input_start();
+    if (code_point > 0xFFFF && mode == UNICODE_MODE_MACOS) {
+        code_point -= 0x10000;
+        tap_hex(0xD800 + (code_point >> 10));
+        tap_hex(0xDC00 + (code_point & 0x3FF));
+    } else {
+        tap_hex(code_point);
+    }
+    unicode_input_finish();
+}
+
+// Only the mode lead-in and finish, no digits
+static void send_lead_in_only(uint32_t code_point) {
+    unicode_input_start();
+    unicode_input_finish();
+}
+
+typedef struct {
+    int      reports;
+    uint32_t us;
+} cost_t;
+
+static cost_t measure(void (*send)(uint32_t), uint32_t code_point) {
+    reports     = 0;
+    stub_now_us = 0;
+    send(code_point);
+    return (cost_t){reports, stub_now_us};
+}
+
+static const char *mode_names[] = {
+    [UNICODE_MODE_MACOS]      = "macOS",
+    [UNICODE_MODE_LINUX]      = "Linux",
+    [UNICODE_MODE_WINDOWS]    = "Windows",
+    [UNICODE_MODE_WINCOMPOSE] = "WinCompose",
+};
+
+int main(void) {
+    static const uint8_t  modes[]       = {UNICODE_MODE_LINUX, UNICODE_MODE_MACOS, UNICODE_MODE_WINCOMPOSE, UNICODE_MODE_WINDOWS};
+    static const uint32_t code_points[] = {0xE9, 0x2764, 0xFE0F, 0x1F602};
+
+    printf("%-11s %-8s %8s %8s %8s %8s %9s %9s %9s\n", "mode", "char", "reports", "batched", "ms", "batched", "chars/s", "batched", "lead-in");
+    printf("%-11s %-8s %8s %8s %8s %8s %9s %9s %9s\n", "", "", "(tapped)", "", "(tapped)", "", "(tapped)", "", "share");
+    for (size_t m = 0; m < sizeof(modes); m++) {
+        mode = modes[m];
+        for (size_t c = 0; c < sizeof(code_points) / sizeof(code_points[0]); c++) {
+            uint32_t cp = code_points[c];
+            cost_t   tapped  = measure(send_unicode_tapped, cp);
+            cost_t   batched = measure(send_unicode_batched, cp);
+            cost_t   lead_in = measure(send_lead_in_only, cp);
+            if (!tapped.reports) {
+                continue; // Not reachable in this mode
+            }
+            printf("%-11s U+%-6X %8d %8d %8.1f %8.1f %9.1f %9.1f %8.0f%%\n", mode_names[mode], cp, tapped.reports, batched.reports, tapped.us / 1000.0, batched.us / 1000.0, 1e6 / tapped.us, 1e6 / batched.us, 100.0 * lead_in.us / batched.us);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+/* Replays idle/burst typing traces through idle.c and reports matrix scans
+ * per second and how long a key change waits for the scan that sees it.
+ * The QMK main loop is modelled as one pass every LOOP_US: a scan when
+ * matrix_can_read() allows it, then housekeeping_task_user(). */
+
+#include "quantum.h"
+
+#define LOOP_US 200 // One main loop pass, scan included
+#define KEY_HOLD_MS 60
+#define KEY_OFFSET_US 3700 // First keystroke of a phase, off the ms grid
+
+bool matrix_can_read(void);
+void housekeeping_task_user(void);
+
+uint32_t stub_now_us;
+static uint32_t last_activity_us;
+static int      rgb_suspends, rgb_wakeups;
+
+uint32_t last_input_activity_elapsed(void) {
+    return (stub_now_us - last_activity_us) / 1000;
+}
+void rgblight_suspend(void) {
+    rgb_suspends++;
+}
+void rgblight_wakeup(void) {
+    rgb_wakeups++;
+}
+void wait_ms(uint16_t ms) {}
+
+typedef struct {
+    const char *name;
+    uint32_t    length_ms;
+    uint32_t    keystroke_ms; // Time between keystrokes, 0 for none
+} phase_t;
+
+// clang-format off
+static const phase_t trace[] = {
+    { "burst",        2000, 150 },
+    { "timing out",  30000,   0 },
+    { "idle",        30000,   0 },
+    { "wake burst",   2000, 150 },
+    { "short pause",  5000,   0 },
+    { "burst",        2000, 120 },
+    { "timing out",  30000,   0 },
+    { "idle",        15000,   0 },
+    { "wake single",   500, 500 },
+};
+// clang-format on
+
+int main(void) {
+    bool     seen = false;
+    uint32_t phase_start_us = 0;
+
+    printf("%-12s %8s %10s %8s %14s %14s\n", "phase", "ms", "scans/s", "changes", "avg lat (us)", "max lat (us)");
+    for (size_t p = 0; p < sizeof(trace) / sizeof(trace[0]); p++) {
+        const phase_t *ph     = &trace[p];
+        uint32_t       scans  = 0, changes = 0;
+        uint64_t       lat_sum = 0;
+        uint32_t       lat_max = 0, changed_at = 0;
+        bool           pending = false;
+
+        for (uint32_t t = 0; t < ph->length_ms * 1000; t += LOOP_US) {
+            stub_now_us = phase_start_us + t;
+
+            // Key is down for KEY_HOLD_MS after every keystroke
+            bool down = ph->keystroke_ms && t >= KEY_OFFSET_US && ((t - KEY_OFFSET_US) / 1000) % ph->keystroke_ms < KEY_HOLD_MS;
+            if (down != seen && !pending) {
+                pending    = true;
+                changed_at = stub_now_us;
+            }
+
+            if (matrix_can_read()) {
+                scans++;
+                if (pending) {
+                    uint32_t lat = stub_now_us - changed_at;
+                    lat_sum += lat;
+                    lat_max = lat > lat_max ? lat : lat_max;
+                    changes++;
+                    pending          = false;
+                    seen             = down;
+                    last_activity_us = stub_now_us;
+                }
+            }
+            housekeeping_task_user();
+        }
+
+        phase_start_us += ph->length_ms * 1000;
+        printf("%-12s %8u %10.0f %8u %14.0f %14u\n", ph->name, ph->length_ms, scans * 1000.0 / ph->length_ms, changes, changes ? (double)lat_sum / changes : 0.0, lat_max);
+    }
+    printf("full rate is %u scans/s, rgb suspended %d times, woken %d times\n", 1000000 / LOOP_US, rgb_suspends, rgb_wakeups);
+    return 0;
+}
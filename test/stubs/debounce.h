@@ -0,0 +1,13 @@
+#pragma once
+
+#include "quantum.h"
+
+#ifndef MATRIX_ROWS
+#    define MATRIX_ROWS 1
+#endif
+
+typedef uint8_t matrix_row_t;
+
+void debounce_init(uint8_t num_rows);
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void debounce_free(void);
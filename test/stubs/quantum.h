@@ -0,0 +1,72 @@
+/* Just enough of QMK to build the keymap's helper modules on the host. The
+ * harnesses define the functions they use, with a simulated clock. */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Simulated time, advanced by the harness
+extern uint32_t stub_now_us;
+
+static inline uint16_t timer_read(void) {
+    return (uint16_t)(stub_now_us / 1000);
+}
+static inline uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(timer_read() - last);
+}
+#define TIMER_DIFF_16(a, b) ((uint16_t)((a) - (b)))
+
+uint32_t last_input_activity_elapsed(void);
+void     rgblight_suspend(void);
+void     rgblight_wakeup(void);
+void     wait_ms(uint16_t ms);
+
+// Flash reads are plain reads on the host
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+
+enum stub_keycodes {
+    KC_NO    = 0x00,
+    KC_A     = 0x04,
+    KC_Z     = 0x1D,
+    KC_1     = 0x1E,
+    KC_0     = 0x27,
+    KC_ENTER = 0x28,
+    KC_SPACE = 0x2C,
+    KC_KP_1  = 0x59,
+    KC_KP_0  = 0x62,
+};
+#define SAFE_RANGE 0x7E00
+
+enum unicode_input_modes {
+    UNICODE_MODE_MACOS,
+    UNICODE_MODE_LINUX,
+    UNICODE_MODE_WINDOWS,
+    UNICODE_MODE_BSD,
+    UNICODE_MODE_WINCOMPOSE,
+    UNICODE_MODE_EMACS,
+    UNICODE_MODE_COUNT,
+};
+
+typedef struct {
+    struct {
+        bool     pressed;
+        uint16_t time;
+    } event;
+    struct {
+        uint8_t count;
+    } tap;
+} keyrecord_t;
+
+uint8_t get_unicode_input_mode(void);
+void    unicode_input_start(void);
+void    unicode_input_finish(void);
+void    add_key(uint8_t keycode);
+void    del_key(uint8_t keycode);
+void    send_keyboard_report(void);
+void    tap_code(uint8_t keycode);
@@ -0,0 +1,34 @@
+/* Model of QMK's default debounce (quantum/debounce/sym_defer_g.c) for
+ * comparison: one global timer, the whole matrix is copied once no key has
+ * changed for DEBOUNCE ms. */
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+static bool     debouncing = false;
+static uint16_t debouncing_time;
+
+void debounce_init(uint8_t num_rows) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool cooked_changed = false;
+
+    if (changed) {
+        debouncing      = true;
+        debouncing_time = timer_read();
+    } else if (debouncing && timer_elapsed(debouncing_time) >= DEBOUNCE) {
+        size_t matrix_size = num_rows * sizeof(matrix_row_t);
+        if (memcmp(cooked, raw, matrix_size) != 0) {
+            memcpy(cooked, raw, matrix_size);
+            cooked_changed = true;
+        }
+        debouncing = false;
+    }
+    return cooked_changed;
+}
+
+void debounce_free(void) {}